@@ -63,11 +63,74 @@ typedef struct termisu_cell_style {
   uint16_t attr;
 } termisu_cell_style_t;
 
+/* One record for termisu_set_cells; the style is embedded by value. */
+typedef struct termisu_cell_write {
+  int32_t x;
+  int32_t y;
+  uint32_t codepoint;
+  termisu_cell_style_t style;
+} termisu_cell_write_t;
+
+/* In-place view of one back-buffer cell (see termisu_map_grid).
+ *
+ * glyph: Unicode scalar value. Values with the high bit set are internal
+ *        grapheme ids; hosts should only write plain codepoints.
+ * fg/bg: packed colors. 0 = default, 1..8 = ANSI-8 index + 1,
+ *        0x01000000 | (index + 1) = ANSI-256, 0x02RRGGBB = RGB.
+ *        The default blank cell uses fg = 8 (white).
+ * attr:  TERMISU attribute bits.
+ * width/continuation: derived by termisu_render_grid; hosts may leave them.
+ *        The column after a wide glyph is reserved as its continuation. */
+typedef struct termisu_grid_cell {
+  uint32_t glyph;
+  uint32_t fg;
+  uint32_t bg;
+  uint16_t attr;
+  uint8_t width;
+  uint8_t continuation;
+} termisu_grid_cell_t;
+
+/* Back-buffer mapping: width * height cells, row-major. Valid until the
+ * generation changes, which happens when a resize event is processed. */
+typedef struct termisu_grid {
+  termisu_grid_cell_t *cells;
+  int32_t width;
+  int32_t height;
+  uint32_t cell_size;
+  uint32_t generation;
+} termisu_grid_t;
+
 typedef struct termisu_size {
   int32_t width;
   int32_t height;
 } termisu_size_t;
 
+/* Render counters (see termisu_render_stats). The per-frame fields describe
+ * the last recorded render or sync; the rest aggregate over all of them.
+ * Times are in nanoseconds. dropped_frames, max_pending_bytes and
+ * pending_bytes (output the terminal had not accepted after the last frame)
+ * stay zero unless non-blocking output is on. */
+typedef struct termisu_render_stats {
+  uint64_t frames;
+  uint32_t dirty_rows;
+  uint32_t cells_diffed;
+  uint32_t cells_emitted;
+  uint32_t batches;
+  uint32_t style_changes;
+  uint32_t cursor_moves;
+  uint32_t bytes_written;
+  uint8_t enabled;
+  uint64_t flush_time_ns;
+  uint64_t render_time_ns;
+  uint64_t mean_render_time_ns;
+  uint64_t max_render_time_ns;
+  uint64_t total_bytes;
+  uint64_t total_cells_emitted;
+  uint64_t dropped_frames;
+  uint32_t max_pending_bytes;
+  uint32_t pending_bytes;
+} termisu_render_stats_t;
+
 typedef struct termisu_event {
   uint8_t event_type;
   uint8_t modifiers;
@@ -121,11 +184,84 @@ TERMISU_STATIC_ASSERT(offsetof(termisu_cell_style_t, bg) == 12,
 TERMISU_STATIC_ASSERT(offsetof(termisu_cell_style_t, attr) == 24,
                       "termisu_cell_style_t.attr offset mismatch");
 
+TERMISU_STATIC_ASSERT(sizeof(termisu_cell_write_t) == 40, "termisu_cell_write_t size mismatch");
+TERMISU_STATIC_ASSERT(offsetof(termisu_cell_write_t, x) == 0,
+                      "termisu_cell_write_t.x offset mismatch");
+TERMISU_STATIC_ASSERT(offsetof(termisu_cell_write_t, y) == 4,
+                      "termisu_cell_write_t.y offset mismatch");
+TERMISU_STATIC_ASSERT(offsetof(termisu_cell_write_t, codepoint) == 8,
+                      "termisu_cell_write_t.codepoint offset mismatch");
+TERMISU_STATIC_ASSERT(offsetof(termisu_cell_write_t, style) == 12,
+                      "termisu_cell_write_t.style offset mismatch");
+
+TERMISU_STATIC_ASSERT(sizeof(termisu_grid_cell_t) == 16, "termisu_grid_cell_t size mismatch");
+TERMISU_STATIC_ASSERT(offsetof(termisu_grid_cell_t, glyph) == 0,
+                      "termisu_grid_cell_t.glyph offset mismatch");
+TERMISU_STATIC_ASSERT(offsetof(termisu_grid_cell_t, fg) == 4,
+                      "termisu_grid_cell_t.fg offset mismatch");
+TERMISU_STATIC_ASSERT(offsetof(termisu_grid_cell_t, bg) == 8,
+                      "termisu_grid_cell_t.bg offset mismatch");
+TERMISU_STATIC_ASSERT(offsetof(termisu_grid_cell_t, attr) == 12,
+                      "termisu_grid_cell_t.attr offset mismatch");
+TERMISU_STATIC_ASSERT(offsetof(termisu_grid_cell_t, width) == 14,
+                      "termisu_grid_cell_t.width offset mismatch");
+TERMISU_STATIC_ASSERT(offsetof(termisu_grid_cell_t, continuation) == 15,
+                      "termisu_grid_cell_t.continuation offset mismatch");
+
+TERMISU_STATIC_ASSERT(sizeof(termisu_grid_t) == 24, "termisu_grid_t size mismatch");
+TERMISU_STATIC_ASSERT(offsetof(termisu_grid_t, cells) == 0, "termisu_grid_t.cells offset mismatch");
+TERMISU_STATIC_ASSERT(offsetof(termisu_grid_t, width) == 8, "termisu_grid_t.width offset mismatch");
+TERMISU_STATIC_ASSERT(offsetof(termisu_grid_t, height) == 12,
+                      "termisu_grid_t.height offset mismatch");
+TERMISU_STATIC_ASSERT(offsetof(termisu_grid_t, cell_size) == 16,
+                      "termisu_grid_t.cell_size offset mismatch");
+TERMISU_STATIC_ASSERT(offsetof(termisu_grid_t, generation) == 20,
+                      "termisu_grid_t.generation offset mismatch");
+
 TERMISU_STATIC_ASSERT(sizeof(termisu_size_t) == 8, "termisu_size_t size mismatch");
 TERMISU_STATIC_ASSERT(offsetof(termisu_size_t, width) == 0, "termisu_size_t.width offset mismatch");
 TERMISU_STATIC_ASSERT(offsetof(termisu_size_t, height) == 4,
                       "termisu_size_t.height offset mismatch");
 
+TERMISU_STATIC_ASSERT(sizeof(termisu_render_stats_t) == 104,
+                      "termisu_render_stats_t size mismatch");
+TERMISU_STATIC_ASSERT(offsetof(termisu_render_stats_t, frames) == 0,
+                      "termisu_render_stats_t.frames offset mismatch");
+TERMISU_STATIC_ASSERT(offsetof(termisu_render_stats_t, dirty_rows) == 8,
+                      "termisu_render_stats_t.dirty_rows offset mismatch");
+TERMISU_STATIC_ASSERT(offsetof(termisu_render_stats_t, cells_diffed) == 12,
+                      "termisu_render_stats_t.cells_diffed offset mismatch");
+TERMISU_STATIC_ASSERT(offsetof(termisu_render_stats_t, cells_emitted) == 16,
+                      "termisu_render_stats_t.cells_emitted offset mismatch");
+TERMISU_STATIC_ASSERT(offsetof(termisu_render_stats_t, batches) == 20,
+                      "termisu_render_stats_t.batches offset mismatch");
+TERMISU_STATIC_ASSERT(offsetof(termisu_render_stats_t, style_changes) == 24,
+                      "termisu_render_stats_t.style_changes offset mismatch");
+TERMISU_STATIC_ASSERT(offsetof(termisu_render_stats_t, cursor_moves) == 28,
+                      "termisu_render_stats_t.cursor_moves offset mismatch");
+TERMISU_STATIC_ASSERT(offsetof(termisu_render_stats_t, bytes_written) == 32,
+                      "termisu_render_stats_t.bytes_written offset mismatch");
+TERMISU_STATIC_ASSERT(offsetof(termisu_render_stats_t, enabled) == 36,
+                      "termisu_render_stats_t.enabled offset mismatch");
+TERMISU_STATIC_ASSERT(offsetof(termisu_render_stats_t, flush_time_ns) == 40,
+                      "termisu_render_stats_t.flush_time_ns offset mismatch");
+TERMISU_STATIC_ASSERT(offsetof(termisu_render_stats_t, render_time_ns) == 48,
+                      "termisu_render_stats_t.render_time_ns offset mismatch");
+TERMISU_STATIC_ASSERT(offsetof(termisu_render_stats_t, mean_render_time_ns) == 56,
+                      "termisu_render_stats_t.mean_render_time_ns offset mismatch");
+TERMISU_STATIC_ASSERT(offsetof(termisu_render_stats_t, max_render_time_ns) == 64,
+                      "termisu_render_stats_t.max_render_time_ns offset mismatch");
+TERMISU_STATIC_ASSERT(offsetof(termisu_render_stats_t, total_bytes) == 72,
+                      "termisu_render_stats_t.total_bytes offset mismatch");
+TERMISU_STATIC_ASSERT(offsetof(termisu_render_stats_t, total_cells_emitted) == 80,
+                      "termisu_render_stats_t.total_cells_emitted offset mismatch");
+TERMISU_STATIC_ASSERT(offsetof(termisu_render_stats_t, dropped_frames) == 88,
+                      "termisu_render_stats_t.dropped_frames offset mismatch");
+TERMISU_STATIC_ASSERT(offsetof(termisu_render_stats_t, max_pending_bytes) == 96,
+                      "termisu_render_stats_t.max_pending_bytes offset mismatch");
+TERMISU_STATIC_ASSERT(offsetof(termisu_render_stats_t, pending_bytes) == 100,
+                      "termisu_render_stats_t.pending_bytes offset mismatch");
+
 TERMISU_STATIC_ASSERT(sizeof(termisu_event_t) == 128, "termisu_event_t size mismatch");
 TERMISU_STATIC_ASSERT(offsetof(termisu_event_t, event_type) == 0,
                       "termisu_event_t.event_type offset mismatch");
@@ -183,6 +319,11 @@ int32_t termisu_close(termisu_handle_t handle);
 int32_t termisu_size(termisu_handle_t handle, termisu_size_t *out_size);
 int32_t termisu_set_sync_updates(termisu_handle_t handle, uint8_t enabled);
 uint8_t termisu_sync_updates(termisu_handle_t handle);
+/* Non-blocking output: renders never wait on a slow terminal and frames the
+ * terminal cannot keep up with are dropped (see dropped_frames and
+ * pending_bytes in termisu_render_stats_t). Off by default. */
+int32_t termisu_set_nonblocking_output(termisu_handle_t handle, uint8_t enabled);
+uint8_t termisu_nonblocking_output(termisu_handle_t handle);
 
 /* Rendering */
 int32_t termisu_clear(termisu_handle_t handle);
@@ -194,16 +335,56 @@ int32_t termisu_show_cursor(termisu_handle_t handle);
 int32_t termisu_set_cell(termisu_handle_t handle, int32_t x, int32_t y, uint32_t codepoint,
                          const termisu_cell_style_t *style);
 
+/* Render metrics. Collection is off until enabled; out_stats is filled
+ * either way (all zero before the first recorded frame). */
+int32_t termisu_set_render_stats_enabled(termisu_handle_t handle, uint8_t enabled);
+int32_t termisu_render_stats(termisu_handle_t handle, termisu_render_stats_t *out_stats);
+int32_t termisu_reset_render_stats(termisu_handle_t handle);
+
+/* Bulk cell writes. Each call resolves the handle once, so prefer these over
+ * per-cell termisu_set_cell loops. out_written (optional, may be NULL)
+ * receives the number of cells actually written; TERMISU_STATUS_REJECTED is
+ * returned when some input could not be placed. */
+int32_t termisu_set_cells(termisu_handle_t handle, const termisu_cell_write_t *cells,
+                          int32_t count, int32_t *out_written);
+int32_t termisu_write_text(termisu_handle_t handle, int32_t x, int32_t y, const uint8_t *text,
+                           uint64_t text_len, const termisu_cell_style_t *style,
+                           int32_t *out_written);
+int32_t termisu_fill_rect(termisu_handle_t handle, int32_t x, int32_t y, int32_t width,
+                          int32_t height, uint32_t codepoint, const termisu_cell_style_t *style);
+
+/* Zero-copy grid. Write cells in place through the mapping, then call
+ * termisu_render_grid with a row bitmap (bit row & 7 of byte row >> 3) of
+ * the rows touched, or NULL to scan every row. Re-map when generation
+ * changes. */
+int32_t termisu_map_grid(termisu_handle_t handle, termisu_grid_t *out_grid);
+int32_t termisu_render_grid(termisu_handle_t handle, const uint8_t *dirty_rows,
+                            uint64_t dirty_rows_len);
+
 /* Input and timer */
 int32_t termisu_enable_timer_ms(termisu_handle_t handle, int32_t interval_ms);
 int32_t termisu_enable_system_timer_ms(termisu_handle_t handle, int32_t interval_ms);
 int32_t termisu_disable_timer(termisu_handle_t handle);
+
+/* Frame pacing. While enabled, termisu_render and termisu_sync only request
+ * a frame; at most one is drawn per timer tick, when the tick is polled,
+ * backing off while the terminal falls behind. Starts a system timer at
+ * interval_ms if none is enabled. Disabling draws any pending frame. */
+int32_t termisu_enable_frame_pacing_ms(termisu_handle_t handle, int32_t interval_ms);
+int32_t termisu_disable_frame_pacing(termisu_handle_t handle);
 int32_t termisu_enable_mouse(termisu_handle_t handle);
 int32_t termisu_disable_mouse(termisu_handle_t handle);
 int32_t termisu_enable_enhanced_keyboard(termisu_handle_t handle);
 int32_t termisu_disable_enhanced_keyboard(termisu_handle_t handle);
 int32_t termisu_poll_event(termisu_handle_t handle, int32_t timeout_ms, termisu_event_t *out_event);
 
+/* Batched polling. Waits at most once for timeout_ms (negative blocks, 0
+ * does not wait), then fills out_events with the first event and every
+ * event already queued, up to capacity. out_count receives the number of
+ * events written; TERMISU_STATUS_TIMEOUT is returned when it is 0. */
+int32_t termisu_poll_events(termisu_handle_t handle, int32_t timeout_ms, termisu_event_t *out_events,
+                            uint64_t capacity, uint64_t *out_count);
+
 /* Error handling */
 uint64_t termisu_last_error_length(void);
 uint64_t termisu_last_error_copy(uint8_t *buffer, uint64_t buffer_len);
@@ -42,11 +42,56 @@ export const STRUCT = {
     bg: 12,
     attr: 24,
   },
+  cellWrite: {
+    size: 40,
+    x: 0,
+    y: 4,
+    codepoint: 8,
+    style: 12,
+  },
+  gridCell: {
+    size: 16,
+    glyph: 0,
+    fg: 4,
+    bg: 8,
+    attr: 12,
+    width: 14,
+    continuation: 15,
+  },
+  grid: {
+    size: 24,
+    cells: 0,
+    width: 8,
+    height: 12,
+    cellSize: 16,
+    generation: 20,
+  },
   size: {
     size: 8,
     width: 0,
     height: 4,
   },
+  renderStats: {
+    size: 104,
+    frames: 0,
+    dirtyRows: 8,
+    cellsDiffed: 12,
+    cellsEmitted: 16,
+    batches: 20,
+    styleChanges: 24,
+    cursorMoves: 28,
+    bytesWritten: 32,
+    enabled: 36,
+    flushTimeNs: 40,
+    renderTimeNs: 48,
+    meanRenderTimeNs: 56,
+    maxRenderTimeNs: 64,
+    totalBytes: 72,
+    totalCellsEmitted: 80,
+    droppedFrames: 88,
+    maxPendingBytes: 96,
+    pendingBytes: 100,
+  },
   event: {
     size: 128,
     eventType: 0,
@@ -94,9 +139,46 @@ const STRUCT_LAYOUT_VALUES = [
   STRUCT.cellStyle.fg,
   STRUCT.cellStyle.bg,
   STRUCT.cellStyle.attr,
+  STRUCT.cellWrite.size,
+  STRUCT.cellWrite.x,
+  STRUCT.cellWrite.y,
+  STRUCT.cellWrite.codepoint,
+  STRUCT.cellWrite.style,
+  STRUCT.gridCell.size,
+  STRUCT.gridCell.glyph,
+  STRUCT.gridCell.fg,
+  STRUCT.gridCell.bg,
+  STRUCT.gridCell.attr,
+  STRUCT.gridCell.width,
+  STRUCT.gridCell.continuation,
+  STRUCT.grid.size,
+  STRUCT.grid.cells,
+  STRUCT.grid.width,
+  STRUCT.grid.height,
+  STRUCT.grid.cellSize,
+  STRUCT.grid.generation,
   STRUCT.size.size,
   STRUCT.size.width,
   STRUCT.size.height,
+  STRUCT.renderStats.size,
+  STRUCT.renderStats.frames,
+  STRUCT.renderStats.dirtyRows,
+  STRUCT.renderStats.cellsDiffed,
+  STRUCT.renderStats.cellsEmitted,
+  STRUCT.renderStats.batches,
+  STRUCT.renderStats.styleChanges,
+  STRUCT.renderStats.cursorMoves,
+  STRUCT.renderStats.bytesWritten,
+  STRUCT.renderStats.enabled,
+  STRUCT.renderStats.flushTimeNs,
+  STRUCT.renderStats.renderTimeNs,
+  STRUCT.renderStats.meanRenderTimeNs,
+  STRUCT.renderStats.maxRenderTimeNs,
+  STRUCT.renderStats.totalBytes,
+  STRUCT.renderStats.totalCellsEmitted,
+  STRUCT.renderStats.droppedFrames,
+  STRUCT.renderStats.maxPendingBytes,
+  STRUCT.renderStats.pendingBytes,
   STRUCT.event.size,
   STRUCT.event.eventType,
   STRUCT.event.modifiers,
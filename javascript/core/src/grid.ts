@@ -0,0 +1,108 @@
+import { ColorMode, STRUCT } from "./constants";
+import type { CellStyle, TermisuColor } from "./types";
+
+// Packed color tags, matching Termisu::Color#packed and termisu_grid_cell_t.
+const PACKED_ANSI256_TAG = 0x0100_0000;
+const PACKED_RGB_TAG = 0x0200_0000;
+
+const WORDS_PER_CELL = STRUCT.gridCell.size / 4;
+const GLYPH_WORD = STRUCT.gridCell.glyph / 4;
+const FG_WORD = STRUCT.gridCell.fg / 4;
+const BG_WORD = STRUCT.gridCell.bg / 4;
+const ATTR_WORD = STRUCT.gridCell.attr / 4;
+
+export interface GridInfo {
+  cellsPtr: number;
+  width: number;
+  height: number;
+  cellSize: number;
+  generation: number;
+}
+
+export function packColor(color?: TermisuColor): number {
+  switch (color?.mode) {
+    case ColorMode.Ansi8:
+      return color.index + 1;
+    case ColorMode.Ansi256:
+      return PACKED_ANSI256_TAG | (color.index + 1);
+    case ColorMode.Rgb:
+      return PACKED_RGB_TAG | (color.r << 16) | (color.g << 8) | color.b;
+    default:
+      return 0;
+  }
+}
+
+// Zero-copy view of the native back buffer (see termisu_map_grid). Writes land
+// directly in Crystal memory; render() hands the dirty-row bitmap to
+// termisu_render_grid. The view is invalidated when the native generation
+// changes (after a resize event), so re-map after polling events.
+export class Grid {
+  readonly width: number;
+  readonly height: number;
+  readonly generation: number;
+  readonly cells: Uint32Array;
+  readonly dirtyRows: Uint8Array;
+
+  private readonly renderFn: (dirtyRows: Uint8Array) => void;
+
+  constructor(info: GridInfo, cells: Uint32Array, renderFn: (dirtyRows: Uint8Array) => void) {
+    if (info.cellSize !== STRUCT.gridCell.size) {
+      throw new Error(
+        `Unsupported grid cell size ${info.cellSize}, expected ${STRUCT.gridCell.size}`
+      );
+    }
+
+    this.width = info.width;
+    this.height = info.height;
+    this.generation = info.generation;
+    this.cells = cells;
+    this.dirtyRows = new Uint8Array(Math.ceil(info.height / 8));
+    this.renderFn = renderFn;
+  }
+
+  // Hot-path writer taking already packed colors (see packColor).
+  setCellPacked(
+    x: number,
+    y: number,
+    codepoint: number,
+    fg: number,
+    bg: number,
+    attr: number = 0
+  ): boolean {
+    if (x < 0 || y < 0 || x >= this.width || y >= this.height) return false;
+
+    const base = (y * this.width + x) * WORDS_PER_CELL;
+    this.cells[base + GLYPH_WORD] = codepoint;
+    this.cells[base + FG_WORD] = fg;
+    this.cells[base + BG_WORD] = bg;
+    // Width and continuation (upper half-word) are derived natively.
+    this.cells[base + ATTR_WORD] = attr & 0xffff;
+    this.markRowDirty(y);
+    return true;
+  }
+
+  setCell(x: number, y: number, char: string | number, style?: CellStyle): boolean {
+    const codepoint = typeof char === "number" ? char : char.codePointAt(0);
+    if (codepoint === undefined) {
+      throw new Error("Character must not be empty");
+    }
+    return this.setCellPacked(
+      x,
+      y,
+      codepoint,
+      packColor(style?.fg),
+      packColor(style?.bg),
+      style?.attr ?? 0
+    );
+  }
+
+  markRowDirty(y: number): void {
+    const byte = y >> 3;
+    this.dirtyRows[byte] = (this.dirtyRows[byte] ?? 0) | (1 << (y & 7));
+  }
+
+  render(): void {
+    this.renderFn(this.dirtyRows);
+    this.dirtyRows.fill(0);
+  }
+}
@@ -2,13 +2,16 @@ export { Attribute, attrs } from "./attribute";
 export { Color } from "./color";
 export { ColorMode, EventType, Status } from "./constants";
 export { TermisuError } from "./errors";
+export { Grid, packColor } from "./grid";
 export { Termisu } from "./termisu";
 export type {
   AnyEvent,
   CellStyle,
+  CellWrite,
   KeyEvent,
   ModeChangeEvent,
   MouseEvent,
+  RenderStats,
   ResizeEvent,
   Size,
   TermisuColor,
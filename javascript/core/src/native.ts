@@ -15,6 +15,11 @@ const SYMBOLS = {
   termisu_size: { args: ["u64", "ptr"], returns: "i32" },
   termisu_set_sync_updates: { args: ["u64", "u8"], returns: "i32" },
   termisu_sync_updates: { args: ["u64"], returns: "u8" },
+  termisu_set_nonblocking_output: { args: ["u64", "u8"], returns: "i32" },
+  termisu_nonblocking_output: { args: ["u64"], returns: "u8" },
+  termisu_set_render_stats_enabled: { args: ["u64", "u8"], returns: "i32" },
+  termisu_render_stats: { args: ["u64", "ptr"], returns: "i32" },
+  termisu_reset_render_stats: { args: ["u64"], returns: "i32" },
 
   termisu_clear: { args: ["u64"], returns: "i32" },
   termisu_render: { args: ["u64"], returns: "i32" },
@@ -23,15 +28,29 @@ const SYMBOLS = {
   termisu_hide_cursor: { args: ["u64"], returns: "i32" },
   termisu_show_cursor: { args: ["u64"], returns: "i32" },
   termisu_set_cell: { args: ["u64", "i32", "i32", "u32", "ptr"], returns: "i32" },
+  termisu_set_cells: { args: ["u64", "ptr", "i32", "ptr"], returns: "i32" },
+  termisu_write_text: {
+    args: ["u64", "i32", "i32", "ptr", "u64", "ptr", "ptr"],
+    returns: "i32",
+  },
+  termisu_map_grid: { args: ["u64", "ptr"], returns: "i32" },
+  termisu_render_grid: { args: ["u64", "ptr", "u64"], returns: "i32" },
+  termisu_fill_rect: {
+    args: ["u64", "i32", "i32", "i32", "i32", "u32", "ptr"],
+    returns: "i32",
+  },
 
   termisu_enable_timer_ms: { args: ["u64", "i32"], returns: "i32" },
   termisu_enable_system_timer_ms: { args: ["u64", "i32"], returns: "i32" },
   termisu_disable_timer: { args: ["u64"], returns: "i32" },
+  termisu_enable_frame_pacing_ms: { args: ["u64", "i32"], returns: "i32" },
+  termisu_disable_frame_pacing: { args: ["u64"], returns: "i32" },
   termisu_enable_mouse: { args: ["u64"], returns: "i32" },
   termisu_disable_mouse: { args: ["u64"], returns: "i32" },
   termisu_enable_enhanced_keyboard: { args: ["u64"], returns: "i32" },
   termisu_disable_enhanced_keyboard: { args: ["u64"], returns: "i32" },
   termisu_poll_event: { args: ["u64", "i32", "ptr"], returns: "i32" },
+  termisu_poll_events: { args: ["u64", "i32", "ptr", "u64", "ptr"], returns: "i32" },
 
   termisu_last_error_length: { args: [], returns: "u64" },
   termisu_last_error_copy: { args: ["ptr", "u64"], returns: "u64" },
@@ -150,4 +169,4 @@ export function loadNative(explicitPath?: string): NativeLibrary {
   return native;
 }
 
-export { ptr } from "bun:ffi";
+export { ptr, toArrayBuffer } from "bun:ffi";
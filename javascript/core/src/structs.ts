@@ -1,5 +1,6 @@
 import { ColorMode, EventType, STRUCT } from "./constants";
-import type { AnyEvent, CellStyle, Size } from "./types";
+import type { GridInfo } from "./grid";
+import type { AnyEvent, CellStyle, CellWrite, RenderStats, Size } from "./types";
 
 const LITTLE_ENDIAN = true;
 const PREEDIT_DECODER = new TextDecoder("utf-8");
@@ -16,6 +17,35 @@ export function readSize(buffer: ArrayBuffer): Size {
   };
 }
 
+export function createRenderStatsBuffer(): ArrayBuffer {
+  return new ArrayBuffer(STRUCT.renderStats.size);
+}
+
+export function readRenderStats(buffer: ArrayBuffer): RenderStats {
+  const view = new DataView(buffer);
+  const layout = STRUCT.renderStats;
+  return {
+    enabled: view.getUint8(layout.enabled) !== 0,
+    frames: view.getBigUint64(layout.frames, LITTLE_ENDIAN),
+    dirtyRows: view.getUint32(layout.dirtyRows, LITTLE_ENDIAN),
+    cellsDiffed: view.getUint32(layout.cellsDiffed, LITTLE_ENDIAN),
+    cellsEmitted: view.getUint32(layout.cellsEmitted, LITTLE_ENDIAN),
+    batches: view.getUint32(layout.batches, LITTLE_ENDIAN),
+    styleChanges: view.getUint32(layout.styleChanges, LITTLE_ENDIAN),
+    cursorMoves: view.getUint32(layout.cursorMoves, LITTLE_ENDIAN),
+    bytesWritten: view.getUint32(layout.bytesWritten, LITTLE_ENDIAN),
+    flushTimeNs: view.getBigUint64(layout.flushTimeNs, LITTLE_ENDIAN),
+    renderTimeNs: view.getBigUint64(layout.renderTimeNs, LITTLE_ENDIAN),
+    meanRenderTimeNs: view.getBigUint64(layout.meanRenderTimeNs, LITTLE_ENDIAN),
+    maxRenderTimeNs: view.getBigUint64(layout.maxRenderTimeNs, LITTLE_ENDIAN),
+    totalBytes: view.getBigUint64(layout.totalBytes, LITTLE_ENDIAN),
+    totalCellsEmitted: view.getBigUint64(layout.totalCellsEmitted, LITTLE_ENDIAN),
+    droppedFrames: view.getBigUint64(layout.droppedFrames, LITTLE_ENDIAN),
+    maxPendingBytes: view.getUint32(layout.maxPendingBytes, LITTLE_ENDIAN),
+    pendingBytes: view.getUint32(layout.pendingBytes, LITTLE_ENDIAN),
+  };
+}
+
 function writeColor(view: DataView, offset: number, color?: CellStyle["fg"]): void {
   const mode = color?.mode ?? ColorMode.Default;
   view.setUint8(offset + STRUCT.color.mode, mode);
@@ -31,23 +61,61 @@ function writeColor(view: DataView, offset: number, color?: CellStyle["fg"]): vo
   view.setUint8(offset + STRUCT.color.b, color?.b ?? 0);
 }
 
+function writeStyle(view: DataView, offset: number, style?: CellStyle): void {
+  writeColor(view, offset + STRUCT.cellStyle.fg, style?.fg);
+  writeColor(view, offset + STRUCT.cellStyle.bg, style?.bg);
+  view.setUint16(offset + STRUCT.cellStyle.attr, style?.attr ?? 0, LITTLE_ENDIAN);
+}
+
 export function createStyleBuffer(style?: CellStyle): ArrayBuffer {
   const buffer = new ArrayBuffer(STRUCT.cellStyle.size);
+  writeStyle(new DataView(buffer), 0, style);
+  return buffer;
+}
+
+// Packs records into one contiguous termisu_cell_write_t array so a batch
+// crosses the FFI boundary in a single call.
+export function createCellWriteBuffer(cells: ReadonlyArray<CellWrite>): ArrayBuffer {
+  const buffer = new ArrayBuffer(STRUCT.cellWrite.size * cells.length);
   const view = new DataView(buffer);
 
-  writeColor(view, STRUCT.cellStyle.fg, style?.fg);
-  writeColor(view, STRUCT.cellStyle.bg, style?.bg);
-  view.setUint16(STRUCT.cellStyle.attr, style?.attr ?? 0, LITTLE_ENDIAN);
+  cells.forEach((cell, index) => {
+    const base = index * STRUCT.cellWrite.size;
+    const codepoint = typeof cell.char === "number" ? cell.char : cell.char.codePointAt(0);
+    if (codepoint === undefined) {
+      throw new Error("Character must not be empty");
+    }
+    view.setInt32(base + STRUCT.cellWrite.x, cell.x, LITTLE_ENDIAN);
+    view.setInt32(base + STRUCT.cellWrite.y, cell.y, LITTLE_ENDIAN);
+    view.setUint32(base + STRUCT.cellWrite.codepoint, codepoint, LITTLE_ENDIAN);
+    writeStyle(view, base + STRUCT.cellWrite.style, cell.style);
+  });
 
   return buffer;
 }
 
-export function createEventBuffer(): ArrayBuffer {
-  return new ArrayBuffer(STRUCT.event.size);
+export function createGridBuffer(): ArrayBuffer {
+  return new ArrayBuffer(STRUCT.grid.size);
 }
 
-export function readEvent(buffer: ArrayBuffer): AnyEvent {
+export function readGrid(buffer: ArrayBuffer): GridInfo {
   const view = new DataView(buffer);
+  return {
+    cellsPtr: Number(view.getBigUint64(STRUCT.grid.cells, LITTLE_ENDIAN)),
+    width: view.getInt32(STRUCT.grid.width, LITTLE_ENDIAN),
+    height: view.getInt32(STRUCT.grid.height, LITTLE_ENDIAN),
+    cellSize: view.getUint32(STRUCT.grid.cellSize, LITTLE_ENDIAN),
+    generation: view.getUint32(STRUCT.grid.generation, LITTLE_ENDIAN),
+  };
+}
+
+export function createEventBuffer(count: number = 1): ArrayBuffer {
+  return new ArrayBuffer(STRUCT.event.size * count);
+}
+
+// Reads the event record starting at byteOffset (for arrays of events).
+export function readEvent(buffer: ArrayBuffer, byteOffset: number = 0): AnyEvent {
+  const view = new DataView(buffer, byteOffset, STRUCT.event.size);
   const type = view.getUint8(STRUCT.event.eventType) as EventType;
   const modifiers = view.getUint8(STRUCT.event.modifiers);
 
@@ -109,7 +177,7 @@ export function readEvent(buffer: ArrayBuffer): AnyEvent {
       // can't read past the buffer (RangeError) and crash event decoding.
       const rawLen = view.getUint8(STRUCT.event.preeditLen);
       const len = Math.min(rawLen, STRUCT.event.preeditTextCapacity);
-      const bytes = new Uint8Array(buffer, STRUCT.event.preeditText, len);
+      const bytes = new Uint8Array(buffer, byteOffset + STRUCT.event.preeditText, len);
       return {
         type,
         modifiers,
@@ -1,16 +1,22 @@
-import { ptr } from "bun:ffi";
+import { type Pointer, ptr, toArrayBuffer } from "bun:ffi";
 
-import { EventType, Status } from "./constants";
+import { EventType, STRUCT, Status } from "./constants";
 import { TermisuError } from "./errors";
+import { Grid } from "./grid";
 import { loadNative, type NativeLibrary } from "./native";
 import {
+  createCellWriteBuffer,
   createEventBuffer,
+  createGridBuffer,
+  createRenderStatsBuffer,
   createSizeBuffer,
   createStyleBuffer,
   readEvent,
+  readGrid,
+  readRenderStats,
   readSize,
 } from "./structs";
-import type { AnyEvent, CellStyle, TermisuOptions } from "./types";
+import type { AnyEvent, CellStyle, CellWrite, RenderStats, TermisuOptions } from "./types";
 
 function asBigInt(value: number | bigint): bigint {
   return typeof value === "bigint" ? value : BigInt(value);
@@ -20,6 +26,11 @@ function asNumber(value: number | bigint): number {
   return typeof value === "number" ? value : Number(value);
 }
 
+const TEXT_ENCODER = new TextEncoder();
+
+// Default cap for pollEvents: large enough for a paste or a mouse drag burst.
+const DEFAULT_EVENT_BATCH = 64;
+
 function firstCodepoint(input: string): number {
   const codepoint = input.codePointAt(0);
   if (codepoint === undefined) {
@@ -44,6 +55,8 @@ export class Termisu {
         "termisu_create"
       );
     }
+
+    if (options.nonblockingOutput) this.setNonblockingOutput(true);
   }
 
   static abiVersion(options: Pick<TermisuOptions, "libraryPath"> = {}): number {
@@ -90,6 +103,26 @@ export class Termisu {
     return value !== 0;
   }
 
+  // Renders never wait on a slow terminal; frames it cannot keep up with are
+  // dropped and counted in renderStats().
+  setNonblockingOutput(enabled: boolean): void {
+    this.assertAlive();
+    const status = asNumber(
+      this.native.symbols.termisu_set_nonblocking_output(this.handle, enabled ? 1 : 0) as
+        | number
+        | bigint
+    );
+    this.assertStatus(status, "termisu_set_nonblocking_output");
+  }
+
+  nonblockingOutput(): boolean {
+    this.assertAlive();
+    const value = asNumber(
+      this.native.symbols.termisu_nonblocking_output(this.handle) as number | bigint
+    );
+    return value !== 0;
+  }
+
   clear(): void {
     this.callVoidStatus("termisu_clear");
   }
@@ -102,6 +135,34 @@ export class Termisu {
     this.callVoidStatus("termisu_sync");
   }
 
+  // Render stats are collected only while enabled; see renderStats().
+  setRenderStatsEnabled(enabled: boolean): void {
+    this.assertAlive();
+    const status = asNumber(
+      this.native.symbols.termisu_set_render_stats_enabled(this.handle, enabled ? 1 : 0) as
+        | number
+        | bigint
+    );
+    this.assertStatus(status, "termisu_set_render_stats_enabled");
+  }
+
+  // Counters of the last recorded render or sync plus running aggregates.
+  renderStats(): RenderStats {
+    this.assertAlive();
+    const buffer = createRenderStatsBuffer();
+    const status = asNumber(
+      this.native.symbols.termisu_render_stats(this.handle, ptr(new Uint8Array(buffer))) as
+        | number
+        | bigint
+    );
+    this.assertStatus(status, "termisu_render_stats");
+    return readRenderStats(buffer);
+  }
+
+  resetRenderStats(): void {
+    this.callVoidStatus("termisu_reset_render_stats");
+  }
+
   setCursor(x: number, y: number): void {
     this.assertAlive();
     const status = asNumber(
@@ -133,6 +194,112 @@ export class Termisu {
     this.assertStatus(status, "termisu_set_cell");
   }
 
+  // Bulk writes return the number of cells written. Rejected input (out of
+  // bounds, clipped, unsupported codepoints) is reflected in the count rather
+  // than thrown; every other non-Ok status still raises.
+  setCells(cells: ReadonlyArray<CellWrite>): number {
+    this.assertAlive();
+    if (cells.length === 0) return 0;
+
+    const records = new Uint8Array(createCellWriteBuffer(cells));
+    const written = new Int32Array(1);
+    const status = asNumber(
+      this.native.symbols.termisu_set_cells(this.handle, ptr(records), cells.length, ptr(written)) as
+        | number
+        | bigint
+    );
+    this.assertBulkStatus(status, "termisu_set_cells");
+    return written[0] ?? 0;
+  }
+
+  writeText(x: number, y: number, text: string, style?: CellStyle): number {
+    this.assertAlive();
+    if (text.length === 0) return 0;
+
+    const bytes = TEXT_ENCODER.encode(text);
+    const styleBuffer = style ? createStyleBuffer(style) : null;
+    const stylePtr = styleBuffer ? ptr(new Uint8Array(styleBuffer)) : 0;
+    const written = new Int32Array(1);
+
+    const status = asNumber(
+      this.native.symbols.termisu_write_text(
+        this.handle,
+        x,
+        y,
+        ptr(bytes),
+        BigInt(bytes.length),
+        stylePtr,
+        ptr(written)
+      ) as number | bigint
+    );
+    this.assertBulkStatus(status, "termisu_write_text");
+    return written[0] ?? 0;
+  }
+
+  fillRect(
+    x: number,
+    y: number,
+    width: number,
+    height: number,
+    char: string | number,
+    style?: CellStyle
+  ): void {
+    this.assertAlive();
+
+    const codepoint = typeof char === "number" ? char : firstCodepoint(char);
+    const styleBuffer = style ? createStyleBuffer(style) : null;
+    const stylePtr = styleBuffer ? ptr(new Uint8Array(styleBuffer)) : 0;
+
+    const status = asNumber(
+      this.native.symbols.termisu_fill_rect(
+        this.handle,
+        x,
+        y,
+        width,
+        height,
+        codepoint,
+        stylePtr
+      ) as number | bigint
+    );
+    this.assertStatus(status, "termisu_fill_rect");
+  }
+
+  // Maps the native back buffer for zero-copy writes; see Grid.
+  mapGrid(): Grid {
+    this.assertAlive();
+
+    const buffer = createGridBuffer();
+    const status = asNumber(
+      this.native.symbols.termisu_map_grid(this.handle, ptr(new Uint8Array(buffer))) as
+        | number
+        | bigint
+    );
+    this.assertStatus(status, "termisu_map_grid");
+
+    const info = readGrid(buffer);
+    const byteLength = info.width * info.height * info.cellSize;
+    const cells =
+      byteLength > 0
+        ? new Uint32Array(toArrayBuffer(info.cellsPtr as Pointer, 0, byteLength))
+        : new Uint32Array(0);
+    return new Grid(info, cells, (dirtyRows) => this.renderGrid(dirtyRows));
+  }
+
+  // Renders after in-place grid writes. Without a bitmap every row is scanned.
+  renderGrid(dirtyRows?: Uint8Array): void {
+    this.assertAlive();
+
+    const bitmap = dirtyRows && dirtyRows.length > 0 ? dirtyRows : null;
+    const status = asNumber(
+      this.native.symbols.termisu_render_grid(
+        this.handle,
+        bitmap ? ptr(bitmap) : 0,
+        BigInt(bitmap ? bitmap.length : 0)
+      ) as number | bigint
+    );
+    this.assertStatus(status, "termisu_render_grid");
+  }
+
   enableTimer(intervalMs: number): void {
     this.assertAlive();
     const status = asNumber(
@@ -153,6 +320,20 @@ export class Termisu {
     this.callVoidStatus("termisu_disable_timer");
   }
 
+  // While enabled, render() and sync() are coalesced into at most one
+  // frame per timer tick; keep polling events so ticks are processed.
+  enableFramePacing(intervalMs = 16): void {
+    this.assertAlive();
+    const status = asNumber(
+      this.native.symbols.termisu_enable_frame_pacing_ms(this.handle, intervalMs) as number | bigint
+    );
+    this.assertStatus(status, "termisu_enable_frame_pacing_ms");
+  }
+
+  disableFramePacing(): void {
+    this.callVoidStatus("termisu_disable_frame_pacing");
+  }
+
   enableMouse(): void {
     this.callVoidStatus("termisu_enable_mouse");
   }
@@ -188,6 +369,42 @@ export class Termisu {
     return event.type === EventType.None ? null : event;
   }
 
+  // Waits at most once, then returns the first event and every event already
+  // queued (up to maxEvents) from a single native call. Empty on timeout.
+  pollEvents(timeoutMs: number = -1, maxEvents: number = DEFAULT_EVENT_BATCH): AnyEvent[] {
+    this.assertAlive();
+    if (!Number.isInteger(maxEvents) || maxEvents <= 0) {
+      throw new RangeError("maxEvents must be a positive integer");
+    }
+
+    const buffer = createEventBuffer(maxEvents);
+    const count = new BigUint64Array(1);
+    const status = asNumber(
+      this.native.symbols.termisu_poll_events(
+        this.handle,
+        timeoutMs,
+        ptr(new Uint8Array(buffer)),
+        BigInt(maxEvents),
+        ptr(count)
+      ) as number | bigint
+    );
+
+    if (status === Status.Timeout) {
+      return [];
+    }
+
+    this.assertStatus(status, "termisu_poll_events");
+    const events: AnyEvent[] = [];
+    const received = Math.min(Number(count[0]), maxEvents);
+    for (let index = 0; index < received; index++) {
+      const event = readEvent(buffer, index * STRUCT.event.size);
+      if (event.type !== EventType.None) {
+        events.push(event);
+      }
+    }
+    return events;
+  }
+
   getLastError(): string {
     const lenRaw = this.native.symbols.termisu_last_error_length() as number | bigint;
     const len = Number(asBigInt(lenRaw));
@@ -210,9 +427,11 @@ export class Termisu {
       | "termisu_clear"
       | "termisu_render"
       | "termisu_sync"
+      | "termisu_reset_render_stats"
       | "termisu_hide_cursor"
       | "termisu_show_cursor"
       | "termisu_disable_timer"
+      | "termisu_disable_frame_pacing"
       | "termisu_enable_mouse"
       | "termisu_disable_mouse"
       | "termisu_enable_enhanced_keyboard"
@@ -229,6 +448,11 @@ export class Termisu {
     }
   }
 
+  private assertBulkStatus(statusValue: number, action: string): void {
+    if (statusValue === Status.Rejected) return;
+    this.assertStatus(statusValue, action);
+  }
+
   private assertStatus(statusValue: number, action: string): void {
     const status = statusValue as Status;
     if (status === Status.Ok) {
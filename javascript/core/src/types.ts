@@ -40,6 +40,13 @@ export interface CellStyle {
   attr?: number;
 }
 
+export interface CellWrite {
+  x: number;
+  y: number;
+  char: string | number;
+  style?: CellStyle;
+}
+
 interface BaseEvent {
   type: EventType;
   modifiers: number;
@@ -100,7 +107,33 @@ export type AnyEvent =
   | PreeditEvent
   | UnknownEvent;
 
+// Render counters (see Termisu#renderStats). The per-frame fields describe
+// the last recorded render or sync; the rest aggregate over all of them.
+// droppedFrames, maxPendingBytes and pendingBytes stay zero unless
+// non-blocking output is on.
+export interface RenderStats {
+  enabled: boolean;
+  frames: bigint;
+  dirtyRows: number;
+  cellsDiffed: number;
+  cellsEmitted: number;
+  batches: number;
+  styleChanges: number;
+  cursorMoves: number;
+  bytesWritten: number;
+  flushTimeNs: bigint;
+  renderTimeNs: bigint;
+  meanRenderTimeNs: bigint;
+  maxRenderTimeNs: bigint;
+  totalBytes: bigint;
+  totalCellsEmitted: bigint;
+  droppedFrames: bigint;
+  maxPendingBytes: number;
+  pendingBytes: number;
+}
+
 export interface TermisuOptions {
   libraryPath?: string;
   syncUpdates?: boolean;
+  nonblockingOutput?: boolean;
 }
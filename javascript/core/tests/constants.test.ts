@@ -21,7 +21,14 @@ describe("constants", () => {
   it("defines expected ABI struct sizes", () => {
     expect(STRUCT.color.size).toBe(12);
     expect(STRUCT.cellStyle.size).toBe(28);
+    expect(STRUCT.cellWrite.size).toBe(40);
+    expect(STRUCT.cellWrite.style).toBe(12);
+    expect(STRUCT.gridCell.size).toBe(16);
+    expect(STRUCT.grid.size).toBe(24);
     expect(STRUCT.size.size).toBe(8);
+    expect(STRUCT.renderStats.size).toBe(104);
+    expect(STRUCT.renderStats.flushTimeNs).toBe(40);
+    expect(STRUCT.renderStats.pendingBytes).toBe(100);
     expect(STRUCT.event.size).toBe(128);
     expect(STRUCT.event.preeditLen).toBe(89);
     expect(STRUCT.event.preeditText).toBe(90);
@@ -2,7 +2,7 @@ import { describe, expect, it } from "bun:test";
 
 import { Status } from "../src/constants";
 import { loadNative, ptr } from "../src/native";
-import { createStyleBuffer } from "../src/structs";
+import { createCellWriteBuffer, createStyleBuffer } from "../src/structs";
 import { Termisu } from "../src/termisu";
 
 function asNumber(value: number | bigint): number {
@@ -57,4 +57,17 @@ describe("FFI integration", () => {
     expect(status).toBe(Status.InvalidHandle);
     expect(readLastError(native)).toMatch(/Invalid handle/);
   });
+
+  it("returns InvalidHandle for set_cells on unknown handle", () => {
+    const native = loadNative();
+    native.symbols.termisu_clear_error();
+
+    const records = new Uint8Array(createCellWriteBuffer([{ x: 0, y: 0, char: "A" }]));
+    const status = asNumber(
+      native.symbols.termisu_set_cells(9999n, ptr(records), 1, 0) as number | bigint
+    );
+
+    expect(status).toBe(Status.InvalidHandle);
+    expect(readLastError(native)).toMatch(/Invalid handle/);
+  });
 });
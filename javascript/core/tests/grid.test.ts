@@ -0,0 +1,72 @@
+import { describe, expect, it } from "bun:test";
+
+import { Color } from "../src/color";
+import { STRUCT } from "../src/constants";
+import { Grid, type GridInfo, packColor } from "../src/grid";
+
+function buildGrid(width: number, height: number) {
+  const info: GridInfo = {
+    cellsPtr: 0,
+    width,
+    height,
+    cellSize: STRUCT.gridCell.size,
+    generation: 3,
+  };
+  const cells = new Uint32Array((width * height * STRUCT.gridCell.size) / 4);
+  const rendered: Uint8Array[] = [];
+  const grid = new Grid(info, cells, (dirty) => rendered.push(dirty.slice()));
+  return { grid, cells, rendered };
+}
+
+describe("Grid", () => {
+  it("packs colors like Termisu::Color#packed", () => {
+    expect(packColor()).toBe(0);
+    expect(packColor(Color.default)).toBe(0);
+    expect(packColor(Color.white)).toBe(8);
+    expect(packColor(Color.ansi256(255))).toBe(0x0100_0100);
+    expect(packColor(Color.rgb(1, 2, 3))).toBe(0x0201_0203);
+  });
+
+  it("writes cells in place and tracks dirty rows", () => {
+    const { grid, cells } = buildGrid(4, 10);
+
+    expect(grid.setCell(1, 9, "A", { fg: Color.red, attr: 1 })).toBe(true);
+    const base = (9 * 4 + 1) * 4;
+    expect(cells[base]).toBe(65);
+    expect(cells[base + 1]).toBe(packColor(Color.red));
+    expect(cells[base + 2]).toBe(0);
+    expect(cells[base + 3]).toBe(1);
+
+    expect(grid.dirtyRows).toHaveLength(2);
+    expect(grid.dirtyRows[1]).toBe(0b10);
+  });
+
+  it("rejects out-of-bounds writes", () => {
+    const { grid } = buildGrid(2, 2);
+    expect(grid.setCellPacked(2, 0, 65, 0, 0)).toBe(false);
+    expect(grid.setCellPacked(0, -1, 65, 0, 0)).toBe(false);
+    expect(grid.dirtyRows[0]).toBe(0);
+  });
+
+  it("hands the bitmap to render and resets it", () => {
+    const { grid, rendered } = buildGrid(2, 3);
+    grid.setCellPacked(0, 2, 65, 0, 0);
+    grid.render();
+
+    expect(rendered).toHaveLength(1);
+    expect(rendered[0]?.[0]).toBe(0b100);
+    expect(grid.dirtyRows[0]).toBe(0);
+    expect(grid.generation).toBe(3);
+  });
+
+  it("refuses mappings with an unexpected cell size", () => {
+    expect(
+      () =>
+        new Grid(
+          { cellsPtr: 0, width: 1, height: 1, cellSize: 12, generation: 0 },
+          new Uint32Array(4),
+          () => undefined
+        )
+    ).toThrow("Unsupported grid cell size");
+  });
+});
@@ -7,6 +7,7 @@ describe("index exports", () => {
     expect(api.Termisu).toBeDefined();
     expect(api.Color).toBeDefined();
     expect(api.Attribute).toBeDefined();
+    expect(api.Grid).toBeDefined();
     expect(api.Status.Ok).toBe(0);
   });
 });
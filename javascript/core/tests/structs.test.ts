@@ -2,10 +2,13 @@ import { describe, expect, it } from "bun:test";
 
 import { ColorMode, EventType, STRUCT } from "../src/constants";
 import {
+  createCellWriteBuffer,
   createEventBuffer,
+  createRenderStatsBuffer,
   createSizeBuffer,
   createStyleBuffer,
   readEvent,
+  readRenderStats,
   readSize,
 } from "../src/structs";
 
@@ -21,6 +24,34 @@ describe("struct helpers", () => {
     expect(readSize(buffer)).toEqual({ width: 120, height: 40 });
   });
 
+  it("reads render stats buffers", () => {
+    const buffer = createRenderStatsBuffer();
+    const view = new DataView(buffer);
+    view.setBigUint64(STRUCT.renderStats.frames, 3n, LE);
+    view.setUint32(STRUCT.renderStats.dirtyRows, 2, LE);
+    view.setUint32(STRUCT.renderStats.cellsEmitted, 14, LE);
+    view.setUint32(STRUCT.renderStats.bytesWritten, 96, LE);
+    view.setUint8(STRUCT.renderStats.enabled, 1);
+    view.setBigUint64(STRUCT.renderStats.renderTimeNs, 250_000n, LE);
+    view.setBigUint64(STRUCT.renderStats.totalCellsEmitted, 40n, LE);
+    view.setBigUint64(STRUCT.renderStats.droppedFrames, 5n, LE);
+    view.setUint32(STRUCT.renderStats.maxPendingBytes, 4096, LE);
+    view.setUint32(STRUCT.renderStats.pendingBytes, 512, LE);
+
+    const stats = readRenderStats(buffer);
+    expect(stats.enabled).toBe(true);
+    expect(stats.frames).toBe(3n);
+    expect(stats.dirtyRows).toBe(2);
+    expect(stats.cellsEmitted).toBe(14);
+    expect(stats.bytesWritten).toBe(96);
+    expect(stats.renderTimeNs).toBe(250_000n);
+    expect(stats.flushTimeNs).toBe(0n);
+    expect(stats.totalCellsEmitted).toBe(40n);
+    expect(stats.droppedFrames).toBe(5n);
+    expect(stats.maxPendingBytes).toBe(4096);
+    expect(stats.pendingBytes).toBe(512);
+  });
+
   it("writes default style values when style is omitted", () => {
     const buffer = createStyleBuffer();
     const view = new DataView(buffer);
@@ -47,6 +78,32 @@ describe("struct helpers", () => {
     expect(view.getUint16(STRUCT.cellStyle.attr, LE)).toBe(0xff);
   });
 
+  it("packs cell write records contiguously", () => {
+    const buffer = createCellWriteBuffer([
+      { x: 1, y: 2, char: "A" },
+      { x: 3, y: 4, char: 0x1f642, style: { attr: 0x01 } },
+    ]);
+    const view = new DataView(buffer);
+    const second = STRUCT.cellWrite.size;
+
+    expect(buffer.byteLength).toBe(STRUCT.cellWrite.size * 2);
+    expect(view.getInt32(STRUCT.cellWrite.x, LE)).toBe(1);
+    expect(view.getInt32(STRUCT.cellWrite.y, LE)).toBe(2);
+    expect(view.getUint32(STRUCT.cellWrite.codepoint, LE)).toBe(65);
+    expect(view.getInt32(second + STRUCT.cellWrite.x, LE)).toBe(3);
+    expect(view.getUint32(second + STRUCT.cellWrite.codepoint, LE)).toBe(0x1f642);
+    expect(view.getUint16(second + STRUCT.cellWrite.style + STRUCT.cellStyle.attr, LE)).toBe(1);
+    expect(
+      view.getInt32(second + STRUCT.cellWrite.style + STRUCT.cellStyle.fg + STRUCT.color.index, LE)
+    ).toBe(-1);
+  });
+
+  it("rejects empty characters in cell write records", () => {
+    expect(() => createCellWriteBuffer([{ x: 0, y: 0, char: "" }])).toThrow(
+      "Character must not be empty"
+    );
+  });
+
   it("defaults non-default color index to zero when omitted", () => {
     const buffer = createStyleBuffer({
       fg: { mode: ColorMode.Ansi8 } as unknown as { mode: ColorMode.Ansi8; index: number },
@@ -178,4 +235,22 @@ describe("struct helpers", () => {
       previous: null,
     });
   });
+
+  it("reads events at an offset within a batch buffer", () => {
+    const batch = createEventBuffer(2);
+    expect(batch.byteLength).toBe(STRUCT.event.size * 2);
+
+    const view = new DataView(batch, STRUCT.event.size);
+    view.setUint8(STRUCT.event.eventType, EventType.Key);
+    view.setInt32(STRUCT.event.keyCode, 66, LE);
+    view.setInt32(STRUCT.event.keyChar, -1, LE);
+
+    expect(readEvent(batch).type).toBe(EventType.None);
+    expect(readEvent(batch, STRUCT.event.size)).toEqual({
+      type: EventType.Key,
+      modifiers: 0,
+      keyCode: 66,
+      keyChar: null,
+    });
+  });
 });
@@ -16,18 +16,37 @@ type TestTermisu = {
   sync(): void;
   setSyncUpdates(enabled: boolean): void;
   syncUpdates(): boolean;
+  setNonblockingOutput(enabled: boolean): void;
+  nonblockingOutput(): boolean;
   setCell(x: number, y: number, char: string | number, style?: unknown): void;
+  setCells(cells: Array<{ x: number; y: number; char: string | number }>): number;
+  writeText(x: number, y: number, text: string, style?: unknown): number;
+  renderGrid(dirtyRows?: Uint8Array): void;
+  setRenderStatsEnabled(enabled: boolean): void;
+  renderStats(): { enabled: boolean; frames: bigint };
+  resetRenderStats(): void;
+  fillRect(
+    x: number,
+    y: number,
+    width: number,
+    height: number,
+    char: string | number,
+    style?: unknown
+  ): void;
   setCursor(x: number, y: number): void;
   hideCursor(): void;
   showCursor(): void;
   enableTimer(intervalMs: number): void;
   enableSystemTimer(intervalMs: number): void;
   disableTimer(): void;
+  enableFramePacing(intervalMs?: number): void;
+  disableFramePacing(): void;
   enableMouse(): void;
   disableMouse(): void;
   enableEnhancedKeyboard(): void;
   disableEnhancedKeyboard(): void;
   pollEvent(timeoutMs?: number): unknown;
+  pollEvents(timeoutMs?: number, maxEvents?: number): unknown[];
   close(): void;
   destroy(): void;
   clearError(): void;
@@ -56,6 +75,8 @@ function buildMockTermisu(
     termisu_size: () => Status.Ok,
     termisu_set_sync_updates: () => Status.Ok,
     termisu_sync_updates: () => 1,
+    termisu_set_nonblocking_output: () => Status.Ok,
+    termisu_nonblocking_output: () => 0,
     termisu_clear: () => Status.Ok,
     termisu_render: () => Status.Ok,
     termisu_sync: () => Status.Ok,
@@ -63,14 +84,25 @@ function buildMockTermisu(
     termisu_hide_cursor: () => Status.Ok,
     termisu_show_cursor: () => Status.Ok,
     termisu_set_cell: () => Status.Ok,
+    termisu_set_cells: () => Status.Ok,
+    termisu_write_text: () => Status.Ok,
+    termisu_fill_rect: () => Status.Ok,
+    termisu_map_grid: () => Status.Ok,
+    termisu_render_grid: () => Status.Ok,
+    termisu_set_render_stats_enabled: () => Status.Ok,
+    termisu_render_stats: () => Status.Ok,
+    termisu_reset_render_stats: () => Status.Ok,
     termisu_enable_timer_ms: () => Status.Ok,
     termisu_enable_system_timer_ms: () => Status.Ok,
     termisu_disable_timer: () => Status.Ok,
+    termisu_enable_frame_pacing_ms: () => Status.Ok,
+    termisu_disable_frame_pacing: () => Status.Ok,
     termisu_enable_mouse: () => Status.Ok,
     termisu_disable_mouse: () => Status.Ok,
     termisu_enable_enhanced_keyboard: () => Status.Ok,
     termisu_disable_enhanced_keyboard: () => Status.Ok,
     termisu_poll_event: () => Status.Ok,
+    termisu_poll_events: () => Status.Ok,
     termisu_last_error_length: () => 0n,
     termisu_last_error_copy: () => 0n,
     termisu_clear_error: () => undefined,
@@ -136,6 +168,19 @@ describe("Termisu wrapper behavior", () => {
     expect(termisu.syncUpdates()).toBe(false);
   });
 
+  it("converts boolean non-blocking output values and reads back bool state", () => {
+    const { termisu, calls } = buildMockTermisu({
+      termisu_nonblocking_output: () => 1,
+    });
+
+    termisu.setNonblockingOutput(true);
+
+    const setCalls = calls.filter((entry) => entry.name === "termisu_set_nonblocking_output");
+    expect(setCalls).toHaveLength(1);
+    expect(setCalls[0]?.args).toEqual([1n, 1]);
+    expect(termisu.nonblockingOutput()).toBe(true);
+  });
+
   it("reads size and forwards cursor coordinates", () => {
     const { termisu, calls } = buildMockTermisu();
 
@@ -177,6 +222,60 @@ describe("Termisu wrapper behavior", () => {
     expect(setCellCalls[1]?.args[4]).toBe(0);
   });
 
+  it("batches cell records into a single set_cells call", () => {
+    const { termisu, calls } = buildMockTermisu();
+
+    expect(termisu.setCells([])).toBe(0);
+    termisu.setCells([
+      { x: 0, y: 0, char: "A" },
+      { x: 1, y: 0, char: 66 },
+    ]);
+
+    const bulkCalls = calls.filter((entry) => entry.name === "termisu_set_cells");
+    expect(bulkCalls).toHaveLength(1);
+    expect(bulkCalls[0]?.args[2]).toBe(2);
+    expect(calls.filter((entry) => entry.name === "termisu_set_cell")).toHaveLength(0);
+  });
+
+  it("passes UTF-8 byte length to write_text and does not throw on rejection", () => {
+    const { termisu, calls } = buildMockTermisu({
+      termisu_write_text: () => Status.Rejected,
+    });
+
+    termisu.writeText(0, 0, "h🙂");
+    const writeCall = calls.find((entry) => entry.name === "termisu_write_text");
+    expect(writeCall?.args[4]).toBe(5n);
+    expect(writeCall?.args[5]).toBe(0);
+  });
+
+  it("forwards fill_rect geometry and codepoint", () => {
+    const { termisu, calls } = buildMockTermisu();
+
+    termisu.fillRect(1, 2, 10, 4, "#");
+    const fillCall = calls.find((entry) => entry.name === "termisu_fill_rect");
+    expect(fillCall?.args.slice(0, 6)).toEqual([1n, 1, 2, 10, 4, "#".codePointAt(0) ?? 0]);
+  });
+
+  it("passes a null bitmap to render_grid unless dirty rows are given", () => {
+    const { termisu, calls } = buildMockTermisu();
+
+    termisu.renderGrid();
+    termisu.renderGrid(new Uint8Array([0b1]));
+
+    const renderCalls = calls.filter((entry) => entry.name === "termisu_render_grid");
+    expect(renderCalls).toHaveLength(2);
+    expect(renderCalls[0]?.args.slice(1)).toEqual([0, 0n]);
+    expect(renderCalls[1]?.args[2]).toBe(1n);
+  });
+
+  it("raises non-rejection failures from bulk writes", () => {
+    const { termisu } = buildMockTermisu({
+      termisu_set_cells: () => Status.InvalidArgument,
+    });
+
+    expect(() => termisu.setCells([{ x: 0, y: 0, char: "A" }])).toThrow(TermisuError);
+  });
+
   it("rejects empty string characters before native call", () => {
     const { termisu, calls } = buildMockTermisu();
     expect(() => termisu.setCell(0, 0, "")).toThrow("Character must not be empty");
@@ -194,6 +293,50 @@ describe("Termisu wrapper behavior", () => {
     expect(okNone.pollEvent(0)).toBeNull();
   });
 
+  it("polls a batch of events in one native call", () => {
+    const { termisu, calls } = buildMockTermisu();
+    expect(termisu.pollEvents(5, 8)).toEqual([]);
+
+    const batchCalls = calls.filter((entry) => entry.name === "termisu_poll_events");
+    expect(batchCalls).toHaveLength(1);
+    expect(batchCalls[0]?.args[1]).toBe(5);
+    expect(batchCalls[0]?.args[3]).toBe(8n);
+
+    const timeout = buildMockTermisu({
+      termisu_poll_events: () => Status.Timeout,
+    }).termisu;
+    expect(timeout.pollEvents(0)).toEqual([]);
+  });
+
+  it("toggles and reads render stats through native symbols", () => {
+    const { termisu, calls } = buildMockTermisu();
+
+    termisu.setRenderStatsEnabled(true);
+    const stats = termisu.renderStats();
+    termisu.resetRenderStats();
+
+    expect(stats.enabled).toBe(false);
+    expect(stats.frames).toBe(0n);
+    const enableCall = calls.find((entry) => entry.name === "termisu_set_render_stats_enabled");
+    expect(enableCall?.args[1]).toBe(1);
+    expect(calls.map((entry) => entry.name)).toContain("termisu_reset_render_stats");
+
+    const failing = buildMockTermisu({
+      termisu_render_stats: () => Status.InvalidHandle,
+    }).termisu;
+    expect(() => failing.renderStats()).toThrow(TermisuError);
+  });
+
+  it("validates pollEvents batch size and raises native failures", () => {
+    const { termisu, calls } = buildMockTermisu({
+      termisu_poll_events: () => Status.InvalidArgument,
+    });
+
+    expect(() => termisu.pollEvents(0, 0)).toThrow(RangeError);
+    expect(calls.filter((entry) => entry.name === "termisu_poll_events")).toHaveLength(0);
+    expect(() => termisu.pollEvents(0, 4)).toThrow(TermisuError);
+  });
+
   it("throws TermisuError and preserves handle when destroy fails", () => {
     const { termisu } = buildMockTermisu({
       termisu_destroy: () => Status.InvalidHandle,
@@ -217,12 +360,18 @@ describe("Termisu wrapper behavior", () => {
     termisu.enableTimer(16);
     termisu.enableSystemTimer(16);
     termisu.disableTimer();
+    termisu.enableFramePacing();
+    termisu.disableFramePacing();
     termisu.clearError();
 
     const names = calls.map((entry) => entry.name);
     expect(names).toContain("termisu_enable_timer_ms");
     expect(names).toContain("termisu_enable_system_timer_ms");
     expect(names).toContain("termisu_disable_timer");
+    expect(names).toContain("termisu_enable_frame_pacing_ms");
+    expect(names).toContain("termisu_disable_frame_pacing");
+    const pacingCall = calls.find((entry) => entry.name === "termisu_enable_frame_pacing_ms");
+    expect(pacingCall?.args[1]).toBe(16);
     expect(names).toContain("termisu_clear_error");
   });
 
@@ -36,6 +36,26 @@ int main(void) {
   assert(handle != 0);
   assert(termisu_set_sync_updates(handle, 1) == TERMISU_STATUS_OK);
   assert(termisu_sync_updates(handle) == 1);
+  assert(termisu_set_nonblocking_output(handle, 1) == TERMISU_STATUS_OK);
+  assert(termisu_nonblocking_output(handle) == 1);
+  assert(termisu_set_nonblocking_output(handle, 0) == TERMISU_STATUS_OK);
+  assert(termisu_nonblocking_output(handle) == 0);
+
+  termisu_render_stats_t render_stats;
+  assert(termisu_set_render_stats_enabled(handle, 1) == TERMISU_STATUS_OK);
+  assert(termisu_render(handle) == TERMISU_STATUS_OK);
+  assert(termisu_render_stats(handle, &render_stats) == TERMISU_STATUS_OK);
+  assert(render_stats.enabled == 1);
+  assert(render_stats.frames == 1);
+  assert(render_stats.dropped_frames == 0);
+  assert(termisu_reset_render_stats(handle) == TERMISU_STATUS_OK);
+  assert(termisu_render_stats(handle, &render_stats) == TERMISU_STATUS_OK);
+  assert(render_stats.frames == 0);
+  assert(termisu_enable_frame_pacing_ms(handle, 0) == TERMISU_STATUS_INVALID_ARGUMENT);
+  termisu_clear_error();
+  assert(termisu_enable_frame_pacing_ms(handle, 16) == TERMISU_STATUS_OK);
+  assert(termisu_render(handle) == TERMISU_STATUS_OK);
+  assert(termisu_disable_frame_pacing(handle) == TERMISU_STATUS_OK);
   assert(termisu_last_error_length() == 0);
   assert(termisu_destroy(handle) == TERMISU_STATUS_OK);
 
@@ -52,11 +72,64 @@ int main(void) {
   read_last_error(error, sizeof(error));
   assert(strstr(error, "out_event is null") != NULL);
 
+  termisu_event_t events[4];
+  uint64_t event_count = 99;
+  termisu_clear_error();
+  assert(termisu_poll_events(0, 0, events, 4, NULL) == TERMISU_STATUS_INVALID_ARGUMENT);
+  read_last_error(error, sizeof(error));
+  assert(strstr(error, "out_count is null") != NULL);
+
+  termisu_clear_error();
+  assert(termisu_poll_events(1234, 0, events, 4, &event_count) == TERMISU_STATUS_INVALID_HANDLE);
+  assert(event_count == 0);
+
   termisu_clear_error();
   assert(termisu_set_cell(1234, 0, 0, 'A', &style) == TERMISU_STATUS_INVALID_HANDLE);
   read_last_error(error, sizeof(error));
   assert(strstr(error, "Invalid handle") != NULL);
 
+  termisu_clear_error();
+  int32_t written = -1;
+  assert(termisu_set_cells(1234, NULL, 1, &written) == TERMISU_STATUS_INVALID_ARGUMENT);
+  read_last_error(error, sizeof(error));
+  assert(strstr(error, "cells is null") != NULL);
+  assert(written == -1);
+
+  termisu_cell_write_t cells[2] = {
+    {.x = 0, .y = 0, .codepoint = 'A', .style = style},
+    {.x = 1, .y = 0, .codepoint = 'B', .style = style},
+  };
+  termisu_clear_error();
+  assert(termisu_set_cells(1234, cells, 2, &written) == TERMISU_STATUS_INVALID_HANDLE);
+  read_last_error(error, sizeof(error));
+  assert(strstr(error, "Invalid handle") != NULL);
+
+  const uint8_t text[] = "hi";
+  termisu_clear_error();
+  assert(termisu_write_text(1234, 0, 0, text, 2, &style, &written) ==
+         TERMISU_STATUS_INVALID_HANDLE);
+
+  termisu_clear_error();
+  assert(termisu_fill_rect(1234, 0, 0, -1, 1, ' ', &style) == TERMISU_STATUS_INVALID_ARGUMENT);
+  read_last_error(error, sizeof(error));
+  assert(strstr(error, "width and height must be >= 0") != NULL);
+
+  termisu_clear_error();
+  assert(termisu_map_grid(1234, NULL) == TERMISU_STATUS_INVALID_ARGUMENT);
+  read_last_error(error, sizeof(error));
+  assert(strstr(error, "out_grid is null") != NULL);
+
+  termisu_grid_t grid;
+  termisu_clear_error();
+  assert(termisu_map_grid(1234, &grid) == TERMISU_STATUS_INVALID_HANDLE);
+  assert(termisu_render_grid(1234, NULL, 0) == TERMISU_STATUS_INVALID_HANDLE);
+
+  termisu_clear_error();
+  assert(termisu_render_stats(1234, NULL) == TERMISU_STATUS_INVALID_ARGUMENT);
+  read_last_error(error, sizeof(error));
+  assert(strstr(error, "out_stats is null") != NULL);
+  assert(termisu_render_stats(1234, &render_stats) == TERMISU_STATUS_INVALID_HANDLE);
+
   puts("C ABI tests passed");
   return 0;
 }